@@ -21,6 +21,8 @@
 #include <asio.hpp>
 using asio::ip::tcp;
 
+#include "ResponseHeaders.h"
+
 class UrlParser;
 
 class Downloader {
@@ -30,7 +32,7 @@ class Downloader {
         unsigned int statusCode = 0;
         std::string redirectUrl;
         std::string messageBody;
-        std::vector<std::string> headers;
+        ResponseHeaders headers;
     };
 
     static Response dumbGet(const std::string &downloadUrl, bool head = false);
@@ -46,6 +48,4 @@ class Downloader {
 
     template<typename Sock>
     static Response _dumbGet(Sock& sock, const UrlParser &url, bool head);
-
-    static constexpr std::string_view LocationTag = "Location: ";
 };
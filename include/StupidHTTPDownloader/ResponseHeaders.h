@@ -0,0 +1,86 @@
+// StupidHTTPDownloader
+// Really stupid library to download HTTP(S) content
+// Copyright (C) 2021 Guillaume Vara
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Raw header block of a response, indexed once at construction.
+// Fields are kept as offsets into a single buffer, so copies / moves stay valid.
+class ResponseHeaders {
+ public:
+    // commonly used headers, indexed for direct lookup
+    enum class Field {
+        CACHE_CONTROL,
+        CONNECTION,
+        CONTENT_DISPOSITION,
+        CONTENT_ENCODING,
+        CONTENT_LENGTH,
+        CONTENT_TYPE,
+        DATE,
+        ETAG,
+        EXPIRES,
+        LAST_MODIFIED,
+        LOCATION,
+        SERVER,
+        TRANSFER_ENCODING,
+        COUNT_
+    };
+
+    ResponseHeaders();
+    explicit ResponseHeaders(std::string rawHeaders);
+
+    size_t size() const;
+    std::string_view name(size_t index) const;
+    std::string_view value(size_t index) const;
+
+    // first occurrence of a field; empty if missing
+    bool has(Field field) const;
+    std::string_view get(Field field) const;
+
+    // case-insensitive lookup of any header; empty if missing
+    std::string_view get(std::string_view name) const;
+
+    // values parsed on demand
+    std::optional<uint64_t> contentLength() const;
+    std::optional<std::time_t> date(Field field) const;
+
+    static std::optional<std::time_t> parseHTTPDate(std::string_view date);
+
+ private:
+    struct Span {
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+    struct Entry {
+        Span name;
+        Span value;
+    };
+
+    static constexpr uint32_t NotFound = UINT32_MAX;
+    static std::optional<Field> _fieldOf(std::string_view name);
+    static bool _iequals(std::string_view a, std::string_view b);
+
+    std::string_view _view(const Span &span) const;
+
+    std::string _buffer;
+    std::vector<Entry> _entries;
+    std::array<uint32_t, static_cast<size_t>(Field::COUNT_)> _fieldIndex;
+};
@@ -111,35 +111,24 @@ Downloader::Response Downloader::_dumbGet(Sock& sock, const UrlParser &url, bool
         std::getline(response_stream, status_message);
 
     // Read the response headers, which are terminated by a blank line.
-    asio::read_until(sock, response, "\r\n\r\n");
+    auto headersLength = asio::read_until(sock, response, "\r\n\r\n");
 
-    // Process the response headers.
-    std::string headerTmp;
-    std::vector<std::string> headers;
-    bool hasContentLengthHeader = false;
-    std::string redirectUrl;
+    // Move the whole header block into a single buffer, leaving any body data behind.
+    auto headersBegin = asio::buffers_begin(response.data());
+    ResponseHeaders headers(std::string(headersBegin, headersBegin + headersLength));
+    response.consume(headersLength);
 
-    // iterate to get headers
-    while (std::getline(response_stream, headerTmp) && headerTmp != "\r") {
-        headers.push_back(headerTmp);
+    if (!headers.size())
+        throw std::logic_error("StupidHTTPDownloader : Response have no headers !");
 
-        //
-        if (!hasContentLengthHeader) {
-            hasContentLengthHeader =
-                headerTmp.find("Content-Length") != std::string::npos;
-        }
+    auto hasContentLengthHeader = headers.has(ResponseHeaders::Field::CONTENT_LENGTH);
 
-        // find redirection url
-        if (status_code == 302 && redirectUrl.empty()) {
-            auto found = headerTmp.find(LocationTag);
-            if (found == std::string::npos) continue;
-            redirectUrl = headerTmp.substr(found + LocationTag.size());
-        }
+    // find redirection url
+    std::string redirectUrl;
+    if (status_code == 302) {
+        redirectUrl = headers.get(ResponseHeaders::Field::LOCATION);
     }
 
-    if (!headers.size())
-        throw std::logic_error("StupidHTTPDownloader : Response have no headers !");
-
     // if not HEAD, read body message
     std::ostringstream output_stream;
     if (!head) {
@@ -162,7 +151,7 @@ Downloader::Response Downloader::_dumbGet(Sock& sock, const UrlParser &url, bool
         status_code,
         redirectUrl,
         output_stream.str(),
-        headers
+        std::move(headers)
     };
 
     spdlog::debug("StupidHTTPDownloader : Response length {}, headers {}",
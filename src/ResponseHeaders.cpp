@@ -0,0 +1,222 @@
+// StupidHTTPDownloader
+// Really stupid library to download HTTP(S) content
+// Copyright (C) 2021 Guillaume Vara
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#include "ResponseHeaders.h"
+
+#include <algorithm>
+#include <charconv>
+#include <utility>
+
+namespace {
+
+// must follow ResponseHeaders::Field order
+constexpr std::array<std::string_view, static_cast<size_t>(ResponseHeaders::Field::COUNT_)> FieldNames {
+    "Cache-Control",
+    "Connection",
+    "Content-Disposition",
+    "Content-Encoding",
+    "Content-Length",
+    "Content-Type",
+    "Date",
+    "ETag",
+    "Expires",
+    "Last-Modified",
+    "Location",
+    "Server",
+    "Transfer-Encoding"
+};
+
+constexpr char toLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr bool isOWS(char c) {
+    return c == ' ' || c == '\t';
+}
+
+std::string_view trimmed(std::string_view str) {
+    while (!str.empty() && isOWS(str.front())) str.remove_prefix(1);
+    while (!str.empty() && (isOWS(str.back()) || str.back() == '\r')) str.remove_suffix(1);
+    return str;
+}
+
+template<typename T>
+bool parseNumber(std::string_view str, T &out) {
+    auto end = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), end, out);
+    return ec == std::errc() && ptr == end;
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+unsigned daysInMonth(unsigned y, unsigned m) {
+    static constexpr std::array<unsigned, 12> days { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return (m == 2 && leap) ? 29 : days[m - 1];
+}
+
+}  // namespace
+
+ResponseHeaders::ResponseHeaders() {
+    this->_fieldIndex.fill(NotFound);
+}
+
+ResponseHeaders::ResponseHeaders(std::string rawHeaders) : ResponseHeaders() {
+    this->_buffer = std::move(rawHeaders);
+    std::string_view raw { this->_buffer };
+
+    size_t lineStart = 0;
+    while (lineStart < raw.size()) {
+        // isolate line, dropping its "\r"
+        auto lineEnd = raw.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) lineEnd = raw.size();
+        auto line = raw.substr(lineStart, lineEnd - lineStart);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        // blank line signals end of headers
+        if (line.empty()) break;
+
+        // split "Name: value", ignoring malformed lines
+        auto colon = line.find(':');
+        if (colon != std::string_view::npos && colon > 0) {
+            auto name = line.substr(0, colon);
+            auto value = trimmed(line.substr(colon + 1));
+
+            Entry entry;
+            entry.name = { static_cast<uint32_t>(name.data() - raw.data()), static_cast<uint32_t>(name.size()) };
+            entry.value = { static_cast<uint32_t>(value.data() - raw.data()), static_cast<uint32_t>(value.size()) };
+
+            // only first occurrence is indexed
+            if (auto field = _fieldOf(name)) {
+                auto &index = this->_fieldIndex[static_cast<size_t>(*field)];
+                if (index == NotFound) index = static_cast<uint32_t>(this->_entries.size());
+            }
+
+            this->_entries.push_back(entry);
+        }
+
+        lineStart = lineEnd + 1;
+    }
+}
+
+size_t ResponseHeaders::size() const {
+    return this->_entries.size();
+}
+
+std::string_view ResponseHeaders::name(size_t index) const {
+    return _view(this->_entries[index].name);
+}
+
+std::string_view ResponseHeaders::value(size_t index) const {
+    return _view(this->_entries[index].value);
+}
+
+bool ResponseHeaders::has(Field field) const {
+    return this->_fieldIndex[static_cast<size_t>(field)] != NotFound;
+}
+
+std::string_view ResponseHeaders::get(Field field) const {
+    auto index = this->_fieldIndex[static_cast<size_t>(field)];
+    if (index == NotFound) return {};
+    return value(index);
+}
+
+std::string_view ResponseHeaders::get(std::string_view name) const {
+    if (auto field = _fieldOf(name)) return get(*field);
+
+    for (const auto &entry : this->_entries) {
+        if (_iequals(_view(entry.name), name)) return _view(entry.value);
+    }
+
+    return {};
+}
+
+std::optional<uint64_t> ResponseHeaders::contentLength() const {
+    uint64_t out;
+    if (!has(Field::CONTENT_LENGTH) || !parseNumber(get(Field::CONTENT_LENGTH), out)) return std::nullopt;
+    return out;
+}
+
+std::optional<std::time_t> ResponseHeaders::date(Field field) const {
+    if (!has(field)) return std::nullopt;
+    return parseHTTPDate(get(field));
+}
+
+// expects IMF-fixdate, eg. "Sun, 06 Nov 1994 08:49:37 GMT" (https://datatracker.ietf.org/doc/html/rfc7231#section-7.1.1.1)
+std::optional<std::time_t> ResponseHeaders::parseHTTPDate(std::string_view date) {
+    if (date.size() != 29 || date.substr(25) != " GMT") return std::nullopt;
+
+    // fixed layout : "Www, DD Mmm YYYY HH:MM:SS GMT"
+    if (date[3] != ',' || date[4] != ' ' || date[7] != ' ' || date[11] != ' ' || date[16] != ' '
+        || date[19] != ':' || date[22] != ':') {
+        return std::nullopt;
+    }
+
+    static constexpr std::array<std::string_view, 7> weekDays {
+        "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"
+    };
+    auto weekDayName = date.substr(0, 3);
+    if (std::find(weekDays.begin(), weekDays.end(), weekDayName) == weekDays.end()) return std::nullopt;
+
+    static constexpr std::array<std::string_view, 12> months {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+    unsigned month = 0;
+    auto monthName = date.substr(8, 3);
+    while (month < months.size() && months[month] != monthName) month++;
+    if (month == months.size()) return std::nullopt;
+
+    // unsigned parsing also rejects any sign
+    unsigned day, year, hour, minute, second;
+    if (!parseNumber(date.substr(5, 2), day)
+        || !parseNumber(date.substr(12, 4), year)
+        || !parseNumber(date.substr(17, 2), hour)
+        || !parseNumber(date.substr(20, 2), minute)
+        || !parseNumber(date.substr(23, 2), second)) {
+        return std::nullopt;
+    }
+
+    if (day < 1 || day > daysInMonth(year, month + 1) || hour > 23 || minute > 59 || second > 60) return std::nullopt;
+
+    auto days = daysFromCivil(year, month + 1, day);
+    return static_cast<std::time_t>(days * 86400 + hour * 3600 + minute * 60 + second);
+}
+
+std::optional<ResponseHeaders::Field> ResponseHeaders::_fieldOf(std::string_view name) {
+    for (size_t i = 0; i < FieldNames.size(); i++) {
+        if (_iequals(FieldNames[i], name)) return static_cast<Field>(i);
+    }
+    return std::nullopt;
+}
+
+bool ResponseHeaders::_iequals(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (toLower(a[i]) != toLower(b[i])) return false;
+    }
+    return true;
+}
+
+std::string_view ResponseHeaders::_view(const Span &span) const {
+    return std::string_view { this->_buffer }.substr(span.offset, span.length);
+}
@@ -18,6 +18,7 @@
 
 #include <StupidHTTPDownloader/Downloader.h>
 #include <StupidHTTPDownloader/UrlParser.h>
+#include <StupidHTTPDownloader/ResponseHeaders.h>
 
 #include <catch2/catch.hpp>
 
@@ -66,3 +67,38 @@ TEST_CASE("No detailed path", "[url_parsing]") {
     REQUIRE(sub[0].undecoded() == "json");
     REQUIRE(p1["format"].undecoded() == "json");
 }
+
+TEST_CASE("Response headers lookup", "[headers]") {
+    ResponseHeaders headers {
+        "content-type: application/json\r\n"
+        "Content-Length:  1234 \r\n"
+        "X-Custom: first\r\n"
+        "Last-Modified: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+        "X-Custom: second\r\n"
+        "Location: https://example.com/next\r\n"
+        "\r\n"
+    };
+    REQUIRE(headers.size() == 6);
+    REQUIRE(headers.name(0) == "content-type");
+    REQUIRE(headers.value(1) == "1234");
+
+    auto copy = headers;
+    REQUIRE(copy.get(ResponseHeaders::Field::CONTENT_TYPE) == "application/json");
+    REQUIRE(copy.get("CONTENT-TYPE") == "application/json");
+    REQUIRE(copy.get("x-custom") == "first");
+    REQUIRE(copy.get("Missing").empty());
+    REQUIRE(!copy.has(ResponseHeaders::Field::ETAG));
+    REQUIRE(copy.get(ResponseHeaders::Field::LOCATION) == "https://example.com/next");
+    REQUIRE(copy.get(ResponseHeaders::Field::LOCATION).back() != '\r');
+
+    REQUIRE(copy.contentLength() == 1234);
+    REQUIRE(copy.date(ResponseHeaders::Field::LAST_MODIFIED) == 784111777);
+    REQUIRE(!copy.date(ResponseHeaders::Field::DATE));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Sunday, 06-Nov-94 08:49:37 GMT"));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Sun, 06 Nov -994 08:49:37 GMT"));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Sun,X06XNovX1994X08:49:37 GMT"));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Xyz, 06 Nov 1994 08:49:37 GMT"));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Sun, 31 Feb 1994 08:49:37 GMT"));
+    REQUIRE(!ResponseHeaders::parseHTTPDate("Sun, 29 Feb 1900 08:49:37 GMT"));
+    REQUIRE(ResponseHeaders::parseHTTPDate("Tue, 29 Feb 2000 00:00:00 GMT") == 951782400);
+}